@@ -0,0 +1,549 @@
+// vV[WeNX`
+#include "ProceduralTexture.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PROCEDURAL_TEXTURE_AVX2
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC/archłAVX2gݍ݊֐g邪Agcc/clang(clang-cl܂)͊֐PʂŋKv
+#if defined(PROCEDURAL_TEXTURE_AVX2) && (defined(__clang__) || defined(__GNUC__))
+#define PROCEDURAL_TEXTURE_AVX2_FUNC __attribute__((target("avx2")))
+#else
+#define PROCEDURAL_TEXTURE_AVX2_FUNC
+#endif
+
+namespace {
+
+    // 1Xbh̍Œs(菭ȂƃXbh̕)
+    constexpr unsigned int MinRowsPerThread = 64;
+
+    // iqmCY̎
+    enum class LatticeBasis {
+        Value,  // iq_̗l
+        Perlin, // iq_̌zƂ̓ς
+    };
+
+    // nbVl[0,1)̕_ɂ(24bit̂ݎĝŌ덷oȂ)
+    inline float HashToUnit(uint32_t h) {
+        return static_cast<float>(h >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // ԗp̂Ȃ߂炩ȋȐ(6t^5-15t^4+10t^3)
+    inline float Fade(float t) {
+        return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+    }
+
+    inline float Lerp(float a, float b, float t) {
+        return a + (b - a) * t;
+    }
+
+    // nbV̉2bit(}1,}1)̌zI(x,y)Ƃ̓ς
+    // ]Ȃ̂AVX2(bitxor)ƌʂv
+    inline float GradDot(uint32_t h, float x, float y) {
+        return ((h & 1u) ? -x : x) + ((h & 2u) ? -y : y);
+    }
+
+    inline unsigned char ToUnorm8(float v) {
+        return static_cast<unsigned char>(std::min(std::max(v, 0.0f), 1.0f) * 255.0f + 0.5f);
+    }
+
+    // NaN╉̒l܂߂Ċiq1~ProceduralMaxFrequencyɎ߂
+    inline float ClampFrequency(float frequency) {
+        if (!(frequency >= 1.0f)) {
+            return 1.0f;
+        }
+        return std::min(frequency, ProceduralMaxFrequency);
+    }
+
+    // VvbNXmCY̒萔
+    constexpr float SimplexF2 = 0.36602540378f; // (3-1)/2 iqOp`iq
+    constexpr float SimplexG2 = 0.21132486540f; // (3-3)/6 Op`iqiq
+    // z(}1,}1)Aa^20.5̂Ƃ̍ől(1/70)1ɂȂ悤Ɋg
+    constexpr float SimplexScale = 70.0f;
+
+    // 1IN^[u̗񂲂Ƃ̊iq(SsŋʂȂ̂ōŏ1񂾂)
+    struct LatticeColumns {
+        std::vector<uint32_t> x0; // ̊iqԍ(Ő܂Ԃς)
+        std::vector<uint32_t> x1; // E̊iqԍ(Ő܂Ԃς)
+        std::vector<float> tx;    // iq̈ʒu(0~1)
+        std::vector<float> ux;    // txFade
+    };
+
+    // 1IN^[u̍s̊iq
+    struct LatticeRow {
+        uint32_t y0, y1;
+        float ty, uy;
+        uint32_t seed;
+        float amplitude;
+    };
+
+    // iqmCY̐ݒ
+    struct LatticeSetup {
+        LatticeBasis basis = LatticeBasis::Value;
+        unsigned int octaves = 1;
+        uint32_t period = 1;   // ŏ̃IN^[ůiq
+        float scaleY = 1.0f;   // sNZiqW(c)
+        float totalAmplitude = 1.0f;
+        std::vector<LatticeColumns> columns; // IN^[u
+    };
+
+    // @brief iqmCY1IN^[uaccumɑ(XJ[)
+    // @param begin,end ͈̔
+    // @remarks AVX2łƌʂ𑵂邽߁Ãt@C/arch:AVX2-march=nativeŃrh(FMAɏk񂳂Ȃ)
+    void AccumulateLatticeScalar(LatticeBasis basis, const LatticeColumns& c, const LatticeRow& r,
+        size_t begin, size_t end, float* accum) {
+        if (basis == LatticeBasis::Value) {
+            for (size_t x = begin; x < end; ++x) {
+                float v00 = HashToUnit(ProceduralHash(c.x0[x], r.y0, r.seed));
+                float v10 = HashToUnit(ProceduralHash(c.x1[x], r.y0, r.seed));
+                float v01 = HashToUnit(ProceduralHash(c.x0[x], r.y1, r.seed));
+                float v11 = HashToUnit(ProceduralHash(c.x1[x], r.y1, r.seed));
+                float n = Lerp(Lerp(v00, v10, c.ux[x]), Lerp(v01, v11, c.ux[x]), r.uy);
+                accum[x] += n * r.amplitude;
+            }
+        }
+        else {
+            const float ty1 = r.ty - 1.0f;
+            for (size_t x = begin; x < end; ++x) {
+                const float tx1 = c.tx[x] - 1.0f;
+                float g00 = GradDot(ProceduralHash(c.x0[x], r.y0, r.seed), c.tx[x], r.ty);
+                float g10 = GradDot(ProceduralHash(c.x1[x], r.y0, r.seed), tx1, r.ty);
+                float g01 = GradDot(ProceduralHash(c.x0[x], r.y1, r.seed), c.tx[x], ty1);
+                float g11 = GradDot(ProceduralHash(c.x1[x], r.y1, r.seed), tx1, ty1);
+                float n = Lerp(Lerp(g00, g10, c.ux[x]), Lerp(g01, g11, c.ux[x]), r.uy);
+                accum[x] += (n * 0.5f + 0.5f) * r.amplitude; // -1~10~1
+            }
+        }
+    }
+
+#ifdef PROCEDURAL_TEXTURE_AVX2
+    // @brief CPUOSAVX2ɑΉĂ邩
+    bool CpuSupportsAvx2() {
+#if defined(_MSC_VER)
+        int info[4] = {};
+        __cpuid(info, 0);
+        if (info[0] < 7) {
+            return false;
+        }
+        __cpuid(info, 1);
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx = (info[2] & (1 << 28)) != 0;
+        // OSYMMWX^ۑĂ邩
+        if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+            return false;
+        }
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2") != 0;
+#endif
+    }
+
+    // ProceduralHash8[
+    PROCEDURAL_TEXTURE_AVX2_FUNC inline __m256i ProceduralHash8(__m256i x, __m256i y, __m256i seedTerm) {
+        __m256i state = _mm256_xor_si256(
+            _mm256_xor_si256(
+                _mm256_mullo_epi32(x, _mm256_set1_epi32(static_cast<int>(0x8da6b343u))),
+                _mm256_mullo_epi32(y, _mm256_set1_epi32(static_cast<int>(0xd8163841u)))),
+            seedTerm);
+        state = _mm256_add_epi32(
+            _mm256_mullo_epi32(state, _mm256_set1_epi32(static_cast<int>(747796405u))),
+            _mm256_set1_epi32(static_cast<int>(2891336453u)));
+        __m256i shift = _mm256_add_epi32(_mm256_srli_epi32(state, 28), _mm256_set1_epi32(4));
+        __m256i word = _mm256_mullo_epi32(
+            _mm256_xor_si256(_mm256_srlv_epi32(state, shift), state),
+            _mm256_set1_epi32(static_cast<int>(277803737u)));
+        return _mm256_xor_si256(_mm256_srli_epi32(word, 22), word);
+    }
+
+    PROCEDURAL_TEXTURE_AVX2_FUNC inline __m256 HashToUnit8(__m256i h) {
+        return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(h, 8)), _mm256_set1_ps(1.0f / 16777216.0f));
+    }
+
+    PROCEDURAL_TEXTURE_AVX2_FUNC inline __m256 Lerp8(__m256 a, __m256 b, __m256 t) {
+        // FMA͎gȂ(XJ[łƊۂ߂𑵂邽)
+        return _mm256_add_ps(a, _mm256_mul_ps(_mm256_sub_ps(b, a), t));
+    }
+
+    PROCEDURAL_TEXTURE_AVX2_FUNC inline __m256 GradDot8(__m256i h, __m256 x, __m256 y) {
+        __m256 sx = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(1)), 31));
+        __m256 sy = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(2)), 30));
+        return _mm256_add_ps(_mm256_xor_ps(x, sx), _mm256_xor_ps(y, sy));
+    }
+
+    // @brief iqmCY1IN^[uaccumɑ(AVX2ŁA8񂸂)
+    // @return (8̔{)Bc̓XJ[łŏ
+    PROCEDURAL_TEXTURE_AVX2_FUNC size_t AccumulateLatticeAvx2(LatticeBasis basis, const LatticeColumns& c,
+        const LatticeRow& r, size_t count, float* accum) {
+        const size_t end = count & ~size_t(7);
+        const __m256i y0 = _mm256_set1_epi32(static_cast<int>(r.y0));
+        const __m256i y1 = _mm256_set1_epi32(static_cast<int>(r.y1));
+        const __m256i seedTerm = _mm256_set1_epi32(static_cast<int>(r.seed * 0xcb1ab31fu));
+        const __m256 uy = _mm256_set1_ps(r.uy);
+        const __m256 amplitude = _mm256_set1_ps(r.amplitude);
+        const __m256 ty = _mm256_set1_ps(r.ty);
+        const __m256 ty1 = _mm256_set1_ps(r.ty - 1.0f);
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 half = _mm256_set1_ps(0.5f);
+        for (size_t x = 0; x < end; x += 8) {
+            __m256i x0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.x0.data() + x));
+            __m256i x1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.x1.data() + x));
+            __m256 ux = _mm256_loadu_ps(c.ux.data() + x);
+            __m256 v00, v10, v01, v11;
+            if (basis == LatticeBasis::Value) {
+                v00 = HashToUnit8(ProceduralHash8(x0, y0, seedTerm));
+                v10 = HashToUnit8(ProceduralHash8(x1, y0, seedTerm));
+                v01 = HashToUnit8(ProceduralHash8(x0, y1, seedTerm));
+                v11 = HashToUnit8(ProceduralHash8(x1, y1, seedTerm));
+            }
+            else {
+                __m256 tx = _mm256_loadu_ps(c.tx.data() + x);
+                __m256 tx1 = _mm256_sub_ps(tx, one);
+                v00 = GradDot8(ProceduralHash8(x0, y0, seedTerm), tx, ty);
+                v10 = GradDot8(ProceduralHash8(x1, y0, seedTerm), tx1, ty);
+                v01 = GradDot8(ProceduralHash8(x0, y1, seedTerm), tx, ty1);
+                v11 = GradDot8(ProceduralHash8(x1, y1, seedTerm), tx1, ty1);
+            }
+            __m256 n = Lerp8(Lerp8(v00, v10, ux), Lerp8(v01, v11, ux), uy);
+            if (basis == LatticeBasis::Perlin) {
+                n = _mm256_add_ps(_mm256_mul_ps(n, half), half);
+            }
+            __m256 a = _mm256_loadu_ps(accum + x);
+            _mm256_storeu_ps(accum + x, _mm256_add_ps(a, _mm256_mul_ps(n, amplitude)));
+        }
+        return end;
+    }
+
+    // VvbNXmCY̒_1̊^(8[)
+    PROCEDURAL_TEXTURE_AVX2_FUNC inline __m256 SimplexCorner8(__m256i ci, __m256i cj, __m256 cx, __m256 cy, __m256i seedTerm) {
+        __m256 a = _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(0.5f), _mm256_mul_ps(cx, cx)), _mm256_mul_ps(cy, cy));
+        const __m256 inside = _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ);
+        a = _mm256_mul_ps(a, a);
+        const __m256 v = _mm256_mul_ps(_mm256_mul_ps(a, a), GradDot8(ProceduralHash8(ci, cj, seedTerm), cx, cy));
+        // åO0(XJ[ł̕Ɠ)
+        return _mm256_and_ps(inside, v);
+    }
+
+    // @brief VvbNXmCY1s(AVX2ŁA8񂸂)
+    // @param scaleX sNZiqW()
+    // @param ny s̊iqW
+    // @param out mCYl(悻-1~1)̏ݐ
+    // @return (8̔{)Bc̓XJ[łŏ
+    PROCEDURAL_TEXTURE_AVX2_FUNC size_t SimplexRowAvx2(float scaleX, float ny, uint32_t seed, size_t count, float* out) {
+        const size_t end = count & ~size_t(7);
+        const __m256i seedTerm = _mm256_set1_epi32(static_cast<int>(seed * 0xcb1ab31fu));
+        const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256i oneI = _mm256_set1_epi32(1);
+        const __m256 y = _mm256_set1_ps(ny);
+        const __m256 scale = _mm256_set1_ps(scaleX);
+        const __m256 f2 = _mm256_set1_ps(SimplexF2);
+        const __m256 g2 = _mm256_set1_ps(SimplexG2);
+        const __m256 g2x2 = _mm256_set1_ps(2.0f * SimplexG2);
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 half = _mm256_set1_ps(0.5f);
+        const __m256 noiseScale = _mm256_set1_ps(SimplexScale);
+        for (size_t x = 0; x < end; x += 8) {
+            const __m256 xf = _mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(x)), lane));
+            const __m256 px = _mm256_mul_ps(_mm256_add_ps(xf, half), scale);
+            const __m256 s = _mm256_mul_ps(_mm256_add_ps(px, y), f2);
+            const __m256 fi = _mm256_floor_ps(_mm256_add_ps(px, s));
+            const __m256 fj = _mm256_floor_ps(_mm256_add_ps(y, s));
+            const __m256 t = _mm256_mul_ps(_mm256_add_ps(fi, fj), g2);
+            const __m256 x0 = _mm256_sub_ps(px, _mm256_sub_ps(fi, t));
+            const __m256 y0 = _mm256_sub_ps(y, _mm256_sub_ps(fj, t));
+            // ǂ̎Op`ɓĂ邩
+            const __m256 lower = _mm256_cmp_ps(x0, y0, _CMP_GT_OQ);
+            const __m256 i1f = _mm256_and_ps(lower, one);
+            const __m256 j1f = _mm256_sub_ps(one, i1f);
+            const __m256i i1 = _mm256_and_si256(_mm256_castps_si256(lower), oneI);
+            const __m256i j1 = _mm256_sub_epi32(oneI, i1);
+            const __m256 x1 = _mm256_add_ps(_mm256_sub_ps(x0, i1f), g2);
+            const __m256 y1 = _mm256_add_ps(_mm256_sub_ps(y0, j1f), g2);
+            const __m256 x2 = _mm256_add_ps(_mm256_sub_ps(x0, one), g2x2);
+            const __m256 y2 = _mm256_add_ps(_mm256_sub_ps(y0, one), g2x2);
+            const __m256i i = _mm256_cvttps_epi32(fi);
+            const __m256i j = _mm256_cvttps_epi32(fj);
+            __m256 n = _mm256_add_ps(
+                SimplexCorner8(i, j, x0, y0, seedTerm),
+                SimplexCorner8(_mm256_add_epi32(i, i1), _mm256_add_epi32(j, j1), x1, y1, seedTerm));
+            n = _mm256_add_ps(n, SimplexCorner8(_mm256_add_epi32(i, oneI), _mm256_add_epi32(j, oneI), x2, y2, seedTerm));
+            _mm256_storeu_ps(out + x, _mm256_mul_ps(n, noiseScale));
+        }
+        return end;
+    }
+#endif // PROCEDURAL_TEXTURE_AVX2
+
+    // @brief AVX2̏g
+    bool UseAvx2(const ProceduralTextureDesc& desc) {
+#ifdef PROCEDURAL_TEXTURE_AVX2
+        static const bool avx2 = CpuSupportsAvx2();
+        return desc.allowSimd && avx2;
+#else
+        (void)desc;
+        return false;
+#endif
+    }
+
+    // @brief iqmCY̏(񂲂Ƃ̊iqԍSIN^[uĂ)
+    // @remarks ł̐܂Ԃ(%)͂łsAsNZƂ̃[vɂ͓Ȃ
+    void SetupLattice(const ProceduralTextureDesc& desc, LatticeBasis basis, unsigned int octaves, LatticeSetup& setup) {
+        // 𐮐̊iqɂĂƒ[Ȃ
+        const auto period = static_cast<uint32_t>(ClampFrequency(desc.frequency) + 0.5f);
+
+        setup.basis = basis;
+        setup.octaves = std::min(std::max(octaves, 1u), ProceduralMaxOctaves);
+        setup.period = period;
+        setup.scaleY = static_cast<float>(period) / static_cast<float>(desc.height);
+        setup.columns.resize(setup.octaves);
+
+        const float scaleX = static_cast<float>(period) / static_cast<float>(desc.width);
+        float total = 0.0f;
+        float amplitude = 0.5f;
+        for (unsigned int o = 0; o < setup.octaves; ++o) {
+            const uint32_t octavePeriod = period << o;
+            const auto octaveScale = static_cast<float>(1u << o);
+            LatticeColumns& c = setup.columns[o];
+            c.x0.resize(desc.width);
+            c.x1.resize(desc.width);
+            c.tx.resize(desc.width);
+            c.ux.resize(desc.width);
+            for (unsigned int x = 0; x < desc.width; ++x) {
+                const float nx = (static_cast<float>(x) + 0.5f) * scaleX * octaveScale;
+                const auto ix = static_cast<uint32_t>(nx);
+                c.x0[x] = ix % octavePeriod;
+                c.x1[x] = (ix + 1) % octavePeriod;
+                c.tx[x] = nx - static_cast<float>(ix);
+                c.ux[x] = Fade(c.tx[x]);
+            }
+            total += amplitude;
+            amplitude *= 0.5f;
+        }
+        setup.totalAmplitude = total;
+    }
+
+    // @brief iqmCY(o[/p[/fBm)1s
+    // @param accum ̍Ɨ̈
+    void FillLatticeRow(const ProceduralTextureDesc& desc, const LatticeSetup& setup, bool useAvx2,
+        TexRGBA* row, unsigned int y, float* accum) {
+        const size_t w = desc.width;
+        std::fill(accum, accum + w, 0.0f);
+        const float ny = (static_cast<float>(y) + 0.5f) * setup.scaleY;
+        float amplitude = 0.5f;
+        for (unsigned int o = 0; o < setup.octaves; ++o) {
+            const uint32_t octavePeriod = setup.period << o;
+            const float nyo = ny * static_cast<float>(1u << o);
+            const auto iy = static_cast<uint32_t>(nyo);
+            LatticeRow r;
+            r.y0 = iy % octavePeriod;
+            r.y1 = (iy + 1) % octavePeriod;
+            r.ty = nyo - static_cast<float>(iy);
+            r.uy = Fade(r.ty);
+            r.seed = desc.seed + o;
+            r.amplitude = amplitude;
+
+            size_t done = 0;
+#ifdef PROCEDURAL_TEXTURE_AVX2
+            if (useAvx2) {
+                done = AccumulateLatticeAvx2(setup.basis, setup.columns[o], r, w, accum);
+            }
+#else
+            (void)useAvx2;
+#endif
+            AccumulateLatticeScalar(setup.basis, setup.columns[o], r, done, w, accum);
+            amplitude *= 0.5f;
+        }
+        for (size_t x = 0; x < w; ++x) {
+            unsigned char c = ToUnorm8(accum[x] / setup.totalAmplitude);
+            row[x] = { c, c, c, 255 };
+        }
+    }
+
+    // @brief 2DVvbNXmCY
+    // @param x,y iqPʂ̍W(0ȏ)
+    // @return -1.0f~1.0f
+    // @remarks SimplexRowAvx2ƓŌvZ邱(ʂrbgPʂő邽)
+    float SimplexNoise(float x, float y, uint32_t seed) {
+        const float s = (x + y) * SimplexF2;
+        const float fi = std::floor(x + s);
+        const float fj = std::floor(y + s);
+        const float t = (fi + fj) * SimplexG2;
+        const float x0 = x - (fi - t);
+        const float y0 = y - (fj - t);
+        // ǂ̎Op`ɓĂ邩
+        const uint32_t i1 = x0 > y0 ? 1u : 0u;
+        const uint32_t j1 = 1u - i1;
+        const float x1 = x0 - static_cast<float>(i1) + SimplexG2;
+        const float y1 = y0 - static_cast<float>(j1) + SimplexG2;
+        const float x2 = x0 - 1.0f + 2.0f * SimplexG2;
+        const float y2 = y0 - 1.0f + 2.0f * SimplexG2;
+        const auto i = static_cast<uint32_t>(fi);
+        const auto j = static_cast<uint32_t>(fj);
+
+        auto corner = [seed](uint32_t ci, uint32_t cj, float cx, float cy) {
+            float a = 0.5f - cx * cx - cy * cy;
+            if (a <= 0.0f) {
+                return 0.0f;
+            }
+            a *= a;
+            return a * a * GradDot(ProceduralHash(ci, cj, seed), cx, cy);
+        };
+        const float n = corner(i, j, x0, y0) + corner(i + i1, j + j1, x1, y1) + corner(i + 1, j + 1, x2, y2);
+        return n * SimplexScale;
+    }
+
+    // @brief VvbNXmCY1s
+    // @param accum ̍Ɨ̈
+    void FillSimplexRow(const ProceduralTextureDesc& desc, bool useAvx2, TexRGBA* row, unsigned int y, float* accum) {
+        const size_t w = desc.width;
+        const float frequency = ClampFrequency(desc.frequency);
+        const float scaleX = frequency / static_cast<float>(desc.width);
+        const float scaleY = frequency / static_cast<float>(desc.height);
+        const float ny = (static_cast<float>(y) + 0.5f) * scaleY;
+        size_t done = 0;
+#ifdef PROCEDURAL_TEXTURE_AVX2
+        if (useAvx2) {
+            done = SimplexRowAvx2(scaleX, ny, desc.seed, w, accum);
+        }
+#else
+        (void)useAvx2;
+#endif
+        for (size_t x = done; x < w; ++x) {
+            const float nx = (static_cast<float>(x) + 0.5f) * scaleX;
+            accum[x] = SimplexNoise(nx, ny, desc.seed);
+        }
+        for (size_t x = 0; x < w; ++x) {
+            unsigned char c = ToUnorm8(accum[x] * 0.5f + 0.5f);
+            row[x] = { c, c, c, 255 };
+        }
+    }
+
+    // @brief zCgmCY1s
+    void FillWhiteNoiseRow(const ProceduralTextureDesc& desc, TexRGBA* row, unsigned int y) {
+        for (unsigned int x = 0; x < desc.width; ++x) {
+            uint32_t h = ProceduralHash(x, y, desc.seed);
+            row[x].R = static_cast<unsigned char>(h);
+            row[x].G = static_cast<unsigned char>(h >> 8);
+            row[x].B = static_cast<unsigned char>(h >> 16);
+            row[x].A = 255;
+        }
+    }
+
+    // @brief Of[V1s
+    void FillGradientRow(const ProceduralTextureDesc& desc, TexRGBA* row, unsigned int y) {
+        const unsigned int dx = std::max(1u, desc.width - 1);
+        const unsigned int dy = std::max(1u, desc.height - 1);
+        const auto g = static_cast<unsigned char>(uint64_t(y) * 255u / dy);
+        for (unsigned int x = 0; x < desc.width; ++x) {
+            row[x] = { static_cast<unsigned char>(uint64_t(x) * 255u / dx), g, 0, 255 };
+        }
+    }
+
+    // @brief `FbJ[1s
+    void FillCheckerRow(const ProceduralTextureDesc& desc, TexRGBA* row, unsigned int y) {
+        const unsigned int size = std::max(1u, desc.checkerSize);
+        const unsigned int cy = y / size;
+        for (unsigned int x = 0; x < desc.width; ++x) {
+            unsigned char c = ((x / size + cy) & 1u) ? 0 : 255;
+            row[x] = { c, c, c, 255 };
+        }
+    }
+
+    // @brief s͈̔[begin,end)𐶐
+    // @param accum mCYp̍Ɨ̈()
+    void GenerateStrip(const ProceduralTextureDesc& desc, const LatticeSetup& lattice, bool useAvx2,
+        unsigned char* base, size_t rowPitch, unsigned int begin, unsigned int end, float* accum) {
+        for (unsigned int y = begin; y < end; ++y) {
+            auto row = reinterpret_cast<TexRGBA*>(base + rowPitch * y);
+            switch (desc.pattern) {
+            case ProceduralPattern::WhiteNoise:
+                FillWhiteNoiseRow(desc, row, y);
+                break;
+            case ProceduralPattern::ValueNoise:
+            case ProceduralPattern::PerlinNoise:
+            case ProceduralPattern::Fbm:
+                FillLatticeRow(desc, lattice, useAvx2, row, y, accum);
+                break;
+            case ProceduralPattern::SimplexNoise:
+                FillSimplexRow(desc, useAvx2, row, y, accum);
+                break;
+            case ProceduralPattern::Gradient:
+                FillGradientRow(desc, row, y);
+                break;
+            case ProceduralPattern::Checker:
+                FillCheckerRow(desc, row, y);
+                break;
+            }
+        }
+    }
+
+} // namespace
+
+void GenerateProceduralTexture(const ProceduralTextureDesc& desc, void* dst, size_t rowPitch) {
+    if (dst == nullptr || desc.width == 0 || desc.height == 0) {
+        return;
+    }
+    auto base = static_cast<unsigned char*>(dst);
+
+    // iqmCY͗񂲂Ƃ̏ɍASXbhŋL
+    LatticeSetup lattice;
+    switch (desc.pattern) {
+    case ProceduralPattern::ValueNoise:
+        SetupLattice(desc, LatticeBasis::Value, 1, lattice);
+        break;
+    case ProceduralPattern::PerlinNoise:
+        SetupLattice(desc, LatticeBasis::Perlin, 1, lattice);
+        break;
+    case ProceduralPattern::Fbm:
+        SetupLattice(desc, LatticeBasis::Value, desc.octaves, lattice);
+        break;
+    default:
+        break;
+    }
+
+    unsigned int threadCount = desc.threadCount;
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threadCount = std::min(threadCount, std::max(1u, desc.height / MinRowsPerThread));
+
+    // Ɨ̈̓Xbh𗧂ĂOɊmۂĂ(XbhŗOoȂ)
+    const unsigned int rowsPerStrip = (desc.height + threadCount - 1) / threadCount;
+    const bool needsAccum = !lattice.columns.empty() || desc.pattern == ProceduralPattern::SimplexNoise;
+    const bool useAvx2 = UseAvx2(desc);
+    std::vector<float> accum(needsAccum ? size_t(desc.width) * threadCount : 0);
+    auto accumFor = [&accum, &desc, needsAccum](unsigned int i) {
+        return needsAccum ? accum.data() + size_t(desc.width) * i : nullptr;
+    };
+
+    // sAтɕăXbhɊ蓖Ă(c̍s͌ĂяoXbhŏ)
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount - 1);
+    unsigned int begin = 0;
+    for (unsigned int i = 0; i + 1 < threadCount && begin < desc.height; ++i) {
+        unsigned int end = std::min(begin + rowsPerStrip, desc.height);
+        try {
+            workers.emplace_back(GenerateStrip, std::cref(desc), std::cref(lattice), useAvx2,
+                base, rowPitch, begin, end, accumFor(i));
+        }
+        catch (const std::system_error&) {
+            // XbhȂc͑S̃XbhŐ
+            break;
+        }
+        begin = end;
+    }
+    GenerateStrip(desc, lattice, useAvx2, base, rowPitch, begin, desc.height,
+        accumFor(static_cast<unsigned int>(workers.size())));
+    for (auto& t : workers) {
+        t.join();
+    }
+}
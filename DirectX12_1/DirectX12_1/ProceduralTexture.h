@@ -0,0 +1,58 @@
+// vV[WeNX`
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// eNX`1sNZ̃f[^(R8G8B8A8)
+struct TexRGBA {
+    unsigned char R, G, B, A;
+};
+
+// ͗l̎
+enum class ProceduralPattern {
+    WhiteNoise,   // sNZƂɓƗRGBmCY
+    ValueNoise,   // iq_̗ԂmCY(O[XP[)
+    PerlinNoise,  // iq_̌zԂp[mCY(O[XP[)
+    SimplexNoise, // Op`iq̃VvbNXmCY(O[XP[)
+                  // [ȂȂ̂ŁAWRAPŃTvOƌpڂ
+    Fbm,          // o[mCYd˂fBm(O[XP[)
+    Gradient,     // RAcG̃Of[V
+    Checker,      // ̃`FbJ[
+};
+
+// fBmŏd˂ő(ȏ͊iqW32bitɎ܂ȂȂ)
+constexpr unsigned int ProceduralMaxOctaves = 16;
+// mCY̊iq̍ől
+constexpr float ProceduralMaxFrequency = 4096.0f;
+
+// vV[WeNX`̐ݒ
+struct ProceduralTextureDesc {
+    unsigned int width = 256;  // (sNZ)
+    unsigned int height = 256; // (sNZ)
+    ProceduralPattern pattern = ProceduralPattern::WhiteNoise;
+    uint32_t seed = 0;         // V[hȂKʂɂȂ
+    float frequency = 8.0f;    // mCY̊iq(eNX`A1~ProceduralMaxFrequency)
+    unsigned int octaves = 5;  // fBmŏd˂(1~ProceduralMaxOctaves)
+    unsigned int checkerSize = 32; // `FbJ[1}X̃sNZ
+    unsigned int threadCount = 0;  // 0Ȃn[hEFAXbh(eNX`ł͎Ō炷)
+    bool allowSimd = true;     // falseȂAVX2gȂ(ʂ͓BeXgp)
+};
+
+// @brief WƃV[h32bit̗(JE^[x[XȂ̂ŏԂȂ)
+// @param x ̃JE^[
+// @param y c̃JE^[
+// @param seed V[h
+// @remarks PCG̏o͊֐gnbVBĂяoXbhɈˑȂ
+inline uint32_t ProceduralHash(uint32_t x, uint32_t y, uint32_t seed) {
+    uint32_t state = (x * 0x8da6b343u) ^ (y * 0xd8163841u) ^ (seed * 0xcb1ab31fu);
+    state = state * 747796405u + 2891336453u;
+    uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+    return (word >> 22u) ^ word;
+}
+
+// @brief vV[WeNX`𐶐ď
+// @param desc ݒ
+// @param dst ݐ̐擪AhX(TexRGBA̔zMapAbv[hobt@[)
+// @param rowPitch 1s̃oCg(Abv[hobt@[ȂRowPitchn)
+// @remarks sƂɕĕXbhŐBʂ̓XbhAVX2̗LɊ֌WȂ
+void GenerateProceduralTexture(const ProceduralTextureDesc& desc, void* dst, size_t rowPitch);
@@ -5,6 +5,7 @@
 #include <dxgi1_6.h>
 #include <DirectXMath.h>
 #include <vector>
+#include "ProceduralTexture.h"
 
 #include <d3dcompiler.h>
 #ifdef _DEBUG
@@ -474,16 +475,12 @@ int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int) {
     scissorrect.bottom = scissorrect.top + window_height; // ؂蔲W
 
     // ̃mCYeNX`̍쐬
-    struct TexRGBA {
-        unsigned char R, G, B, A;
-    };
-    std::vector<TexRGBA> texturedata(256 * 256);
-    for (auto& rgba : texturedata) {
-        rgba.R = rand() % 256;
-        rgba.G = rand() % 256;
-        rgba.B = rand() % 256;
-        rgba.A = 255; // 1.0Ƃ
-    }
+    ProceduralTextureDesc texGenDesc = {};
+    texGenDesc.width = 256;
+    texGenDesc.height = 256;
+    texGenDesc.pattern = ProceduralPattern::WhiteNoise; // 1.0ɂȂ
+    std::vector<TexRGBA> texturedata(texGenDesc.width * texGenDesc.height);
+    GenerateProceduralTexture(texGenDesc, texturedata.data(), sizeof(TexRGBA) * texGenDesc.width);
     // eNX`obt@[̍쐬
     // WriteToSubresourceœ]邽߂̃q[vݒ
     D3D12_HEAP_PROPERTIES texHeapProp = {};
@@ -500,8 +497,8 @@ int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int) {
     // \[X̐ݒ
     D3D12_RESOURCE_DESC resDesc = {};
     resDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM; // RGBAtH[}bg
-    resDesc.Width = 256; // 
-    resDesc.Height = 256; // 
+    resDesc.Width = texGenDesc.width; // 
+    resDesc.Height = texGenDesc.height; // 
     resDesc.DepthOrArraySize = 1; // 2DŔzłȂ̂1
     resDesc.SampleDesc.Count = 1; // ʏeNX`Ȃ̂ŃA`GCAVOȂ
     resDesc.SampleDesc.Quality = 0; // NIeB͍Œ
@@ -524,7 +521,7 @@ int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int) {
         0,
         nullptr, // S̈փRs[
         texturedata.data(), //f[^AhX
-        sizeof(TexRGBA) * 256, // 1CTCY
+        sizeof(TexRGBA) * texGenDesc.width, // 1CTCY
         sizeof(TexRGBA) * texturedata.size() // STCY
     );
 
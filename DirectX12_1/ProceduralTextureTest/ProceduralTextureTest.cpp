@@ -0,0 +1,210 @@
+// vV[WeNX`̌萫eXgƃx`}[N
+#include "../DirectX12_1/ProceduralTexture.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct PatternInfo {
+        ProceduralPattern pattern;
+        const char* name;
+    };
+
+    const PatternInfo patterns[] = {
+        { ProceduralPattern::WhiteNoise, "WhiteNoise" },
+        { ProceduralPattern::ValueNoise, "ValueNoise" },
+        { ProceduralPattern::PerlinNoise, "PerlinNoise" },
+        { ProceduralPattern::SimplexNoise, "SimplexNoise" },
+        { ProceduralPattern::Fbm, "Fbm" },
+        { ProceduralPattern::Gradient, "Gradient" },
+        { ProceduralPattern::Checker, "Checker" },
+    };
+
+    // 1s̖ɗ]ăAbv[hobt@[Ɠ`ɂ
+    size_t AlignedPitch(unsigned int width) {
+        return (size_t(width) * sizeof(TexRGBA) + 255) & ~size_t(255);
+    }
+
+    const unsigned char paddingByte = 0xcd;
+
+    // @brief ʂ̃nbV(FNV-1a)߂
+    // @param paddingOk s̗]ĂȂtrue
+    uint64_t GenerateAndHash(const ProceduralTextureDesc& desc, bool& paddingOk) {
+        const size_t rowBytes = size_t(desc.width) * sizeof(TexRGBA);
+        const size_t pitch = AlignedPitch(desc.width);
+        std::vector<unsigned char> buffer(pitch * desc.height, paddingByte);
+        GenerateProceduralTexture(desc, buffer.data(), pitch);
+
+        uint64_t hash = 14695981039346656037ull;
+        paddingOk = true;
+        for (unsigned int y = 0; y < desc.height; ++y) {
+            const unsigned char* row = buffer.data() + pitch * y;
+            for (size_t i = 0; i < rowBytes; ++i) {
+                hash = (hash ^ row[i]) * 1099511628211ull;
+            }
+            for (size_t i = rowBytes; i < pitch; ++i) {
+                paddingOk = paddingOk && row[i] == paddingByte;
+            }
+        }
+        return hash;
+    }
+
+    // @brief XbhAVX2̗LςĂʂׂ
+    // @return sgݍ킹̐
+    int TestDeterminism() {
+        struct Size {
+            unsigned int width, height;
+        };
+        const Size sizes[] = { { 256, 256 }, { 257, 131 }, { 1000, 129 }, { 61, 7 }, { 1, 1 } };
+        const unsigned int threadCounts[] = { 1, 2, 3, 7, 0 };
+
+        int failures = 0;
+        for (const auto& p : patterns) {
+            for (const auto& s : sizes) {
+                const int failuresBefore = failures;
+                ProceduralTextureDesc desc;
+                desc.width = s.width;
+                desc.height = s.height;
+                desc.pattern = p.pattern;
+                desc.seed = 42;
+                desc.threadCount = 1;
+                desc.allowSimd = false;
+                bool paddingOk = true;
+                const uint64_t reference = GenerateAndHash(desc, paddingOk);
+                for (bool simd : { false, true }) {
+                    for (unsigned int threads : threadCounts) {
+                        desc.allowSimd = simd;
+                        desc.threadCount = threads;
+                        const uint64_t hash = GenerateAndHash(desc, paddingOk);
+                        if (hash != reference || !paddingOk) {
+                            printf("FAIL %-12s %ux%u threads=%u simd=%d hash=%016llx expected=%016llx%s\n",
+                                p.name, s.width, s.height, threads, simd ? 1 : 0,
+                                static_cast<unsigned long long>(hash), static_cast<unsigned long long>(reference),
+                                paddingOk ? "" : " (padding overwritten)");
+                            ++failures;
+                        }
+                    }
+                }
+                if (failures == failuresBefore) {
+                    printf("ok   %-12s %ux%u hash=%016llx\n", p.name, s.width, s.height,
+                        static_cast<unsigned long long>(reference));
+                }
+            }
+        }
+        return failures;
+    }
+
+    // @brief ͈͊O̐ݒnĂȂׂ
+    // @return sgݍ킹̐
+    int TestOutOfRangeDesc() {
+        const float frequencies[] = { -3.0f, 0.0f, std::numeric_limits<float>::quiet_NaN(),
+            std::numeric_limits<float>::infinity(), 1.0e9f };
+        int failures = 0;
+        for (float frequency : frequencies) {
+            for (unsigned int octaves : { 0u, 16u, 64u, 0xffffffffu }) {
+                ProceduralTextureDesc desc;
+                desc.width = 67;
+                desc.height = 33;
+                desc.pattern = ProceduralPattern::Fbm;
+                desc.frequency = frequency;
+                desc.octaves = octaves;
+                for (auto pattern : { ProceduralPattern::Fbm, ProceduralPattern::SimplexNoise }) {
+                    desc.pattern = pattern;
+                    bool paddingOk = true;
+                    GenerateAndHash(desc, paddingOk);
+                    if (!paddingOk) {
+                        printf("FAIL pattern=%d frequency=%g octaves=%u (padding overwritten)\n",
+                            static_cast<int>(pattern), static_cast<double>(frequency), octaves);
+                        ++failures;
+                    }
+                }
+            }
+        }
+        if (failures == 0) {
+            printf("ok   out-of-range frequency/octaves\n");
+        }
+        return failures;
+    }
+
+    // @brief mCY0~255̂قڑSgĂ邩ׂ(g嗦̊ԈႢo)
+    // @return sp^[̐
+    int TestNoiseRange() {
+        const PatternInfo noises[] = {
+            { ProceduralPattern::ValueNoise, "ValueNoise" },
+            { ProceduralPattern::PerlinNoise, "PerlinNoise" },
+            { ProceduralPattern::SimplexNoise, "SimplexNoise" },
+        };
+        const int margin = 16; // [炱ȓɓ͂ΗǂƂ
+        int failures = 0;
+        for (const auto& p : noises) {
+            ProceduralTextureDesc desc;
+            desc.width = 1024;
+            desc.height = 1024;
+            desc.pattern = p.pattern;
+            desc.frequency = 128.0f;
+            std::vector<TexRGBA> texture(size_t(desc.width) * desc.height);
+            int lo = 255;
+            int hi = 0;
+            for (uint32_t seed = 0; seed < 4; ++seed) {
+                desc.seed = seed;
+                GenerateProceduralTexture(desc, texture.data(), sizeof(TexRGBA) * desc.width);
+                for (const auto& texel : texture) {
+                    lo = std::min<int>(lo, texel.R);
+                    hi = std::max<int>(hi, texel.R);
+                }
+            }
+            if (lo > margin || hi < 255 - margin) {
+                printf("FAIL %-12s range=%d..%d (expected about 0..255)\n", p.name, lo, hi);
+                ++failures;
+            }
+            else {
+                printf("ok   %-12s range=%d..%d\n", p.name, lo, hi);
+            }
+        }
+        return failures;
+    }
+
+    // @brief 4096x4096𐶐鑬x𑪂
+    void Benchmark() {
+        const unsigned int size = 4096;
+        std::vector<TexRGBA> texture(size_t(size) * size);
+        for (const auto& p : patterns) {
+            for (unsigned int threads : { 1u, 0u }) {
+                ProceduralTextureDesc desc;
+                desc.width = size;
+                desc.height = size;
+                desc.pattern = p.pattern;
+                desc.threadCount = threads;
+                // 3񑪂Ĉԑ̂g
+                double best = std::numeric_limits<double>::max();
+                for (int i = 0; i < 3; ++i) {
+                    auto start = std::chrono::steady_clock::now();
+                    GenerateProceduralTexture(desc, texture.data(), sizeof(TexRGBA) * size);
+                    auto end = std::chrono::steady_clock::now();
+                    best = std::min(best, std::chrono::duration<double>(end - start).count());
+                }
+                printf("bench %-12s %ux%u threads=%-2u %8.1f Mtexels/sec\n", p.name, size, size,
+                    threads, double(texture.size()) / best / 1.0e6);
+            }
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int failures = TestDeterminism();
+    failures += TestOutOfRangeDesc();
+    failures += TestNoiseRange();
+    // --no-benchtƃx`}[Nȗ
+    const bool bench = !(argc > 1 && std::string(argv[1]) == "--no-bench");
+    if (failures == 0 && bench) {
+        Benchmark();
+    }
+    printf("%s (%d failures)\n", failures == 0 ? "PASSED" : "FAILED", failures);
+    return failures == 0 ? 0 : 1;
+}